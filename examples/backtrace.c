@@ -0,0 +1,66 @@
+// dladdr needs _GNU_SOURCE on glibc; build with -fno-omit-frame-pointer -rdynamic
+#define _GNU_SOURCE
+#define RESULT_FEATURE_BACKTRACE
+// Cold paths keep the error helpers out of line, so the first recorded frame
+// is the function that failed, in header-only builds too
+#define RESULT_FEATURE_COLD_PATHS
+#define RESULT_IMPLEMENTATION
+#include "../result.h"
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            return 1; \
+        } \
+    } while (0)
+
+const char *symbol_name(const void *pc)
+{
+    Dl_info info;
+
+    if (dladdr((const char *)pc - 1, &info) == 0 || info.dli_sname == NULL)
+        return "?";
+    return info.dli_sname;
+}
+
+__attribute__((noinline)) Result(Long) parse_timeout(const char *value)
+{
+    errno = 0;
+    long timeout = strtol(value, NULL, 10);
+
+    if (errno != 0)
+        return Fail_from_errno(Long, STANDARD_DOMAIN, errno, STD_ERR_GENERIC);
+    return Ok(Long, timeout);
+}
+
+__attribute__((noinline)) Result(Long) load_settings(const char *value)
+{
+    Result(Long) timeout = parse_timeout(value);
+
+    if (is_error(timeout))
+        return Propagate(Long, unwrap_error(timeout));
+    return timeout;
+}
+
+int main()
+{
+    Result(Long) res = load_settings("99999999999999999999999");
+    CHECK(is_error(res));
+    print_error_chain(stdout, unwrap_error(res));
+
+    // Each error records where it was created, not the helpers that built it
+    const Error *propagated = unwrap_error(res);
+    const Error *root = propagated->cause;
+    CHECK(root != NULL);
+#if defined(__x86_64__) || defined(__aarch64__)
+    CHECK(root->backtrace_depth >= 2 && propagated->backtrace_depth >= 2);
+    CHECK(strcmp(symbol_name(root->backtrace[0]), "parse_timeout") == 0);
+    CHECK(strcmp(symbol_name(root->backtrace[1]), "load_settings") == 0);
+    CHECK(strcmp(symbol_name(propagated->backtrace[0]), "load_settings") == 0);
+    CHECK(strcmp(symbol_name(propagated->backtrace[1]), "main") == 0);
+#endif
+
+    printf("All backtrace checks passed\n");
+    return 0;
+}
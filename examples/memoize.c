@@ -0,0 +1,131 @@
+#include "../result.h"
+#include <ctype.h>
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            return 1; \
+        } \
+    } while (0)
+
+typedef struct {
+    char hostname[32];
+} HostKey;
+
+// 1. A small per-thread cache of validation results, failures included
+DEFINE_RESULT_MEMO_THREAD_LOCAL(Hostname, Int, HostKey, 64)
+
+static int validations;
+
+Result(Int) validate_hostname(const char *hostname)
+{
+    size_t len = strlen(hostname);
+
+    validations++;
+    if (len == 0)
+        return Fail(Int, PARSE_DOMAIN, PARSE_ERR_UNEXPECTED_END);
+    for (size_t i = 0; i < len; ++i)
+        if (!isalnum((unsigned char)hostname[i]) && hostname[i] != '-' && hostname[i] != '.')
+            return Fail_fmt(Int, PARSE_DOMAIN, PARSE_ERR_UNEXPECTED_CHARACTER,
+                "Invalid character '%c' in hostname \"%s\"", hostname[i], hostname);
+
+    return Ok(Int, (int)len);
+}
+
+Result(Int) validate_hostname_cached(const char *hostname)
+{
+    // 2. The key must fully determine the result: names that do not fit
+    //    would be truncated into another name's key, so bypass the cache
+    HostKey key = {0};
+    if (strlen(hostname) >= sizeof(key.hostname))
+        return validate_hostname(hostname);
+
+    // 3. The key is compared byte by byte: start from a zeroed key
+    strcpy(key.hostname, hostname);
+
+    return RESULT_MEMOIZE(Hostname, key, validate_hostname(hostname));
+}
+
+// 4. Failures are kept in a quarter of the capacity by default, or in an explicit slot count
+DEFINE_RESULT_MEMO(Mixed, Int, int, 256)
+DEFINE_RESULT_MEMO(Parity, Int, int, 256, 32)
+
+static int evaluations[2048];
+
+Result(Int) check_even(int n)
+{
+    evaluations[n]++;
+    if (n % 2)
+        return Fail_fmt(Int, MATH_DOMAIN, MATH_ERR_INVALID_OPERATION, "%d is odd", n);
+    return Ok(Int, n / 2);
+}
+
+int main()
+{
+    const char *hosts[] = { "example.com", "bad_host", "example.com", "bad_host", "localhost" };
+    const Error *cached_error = NULL;
+
+    // 5. Repeated lookups, successful or not, hit the cache
+    for (size_t i = 0; i < sizeof(hosts) / sizeof(hosts[0]); ++i) {
+        Result(Int) res = validate_hostname_cached(hosts[i]);
+        if (is_ok(res))
+            printf("%s: valid (%d characters)\n", hosts[i], unwrap_ok(res));
+        else {
+            printf("%s: %s\n", hosts[i], error_msg(res));
+            CHECK(cached_error == NULL || cached_error == unwrap_error(res));
+            cached_error = unwrap_error(res);
+        }
+    }
+    ResultMemoStats stats = RESULT_MEMO_STATS(Hostname);
+    printf("hits: %zu, misses: %zu, evictions: %zu\n", stats.hits, stats.misses, stats.evictions);
+    CHECK(stats.hits == 2 && stats.misses == 3 && stats.evictions == 0);
+    CHECK(validations == 3);
+
+    // 6. Cached failures are detached from the error pools and survive wraparound
+    for (int i = 0; i < RESULT_ERROR_POOL_SIZE * 2; ++i)
+        (void)Fail(Void, STANDARD_DOMAIN, STD_ERR_GENERIC);
+    print_error_chain(stdout, cached_error);
+    CHECK(cached_error->type_code == PARSE_ERR_UNEXPECTED_CHARACTER);
+    CHECK(strcmp(cached_error->message, "Invalid character '_' in hostname \"bad_host\"") == 0);
+    CHECK(unwrap_error(validate_hostname_cached("bad_host")) == cached_error);
+
+    // 7. Names longer than the key bypass the cache
+    Result(Int) res = validate_hostname_cached("a-very-long-subdomain.example.com");
+    CHECK(is_ok(res) && unwrap_ok(res) == 33);
+    res = validate_hostname_cached("a-very-long-subdomain.example.co_");
+    CHECK(is_error(res));
+    CHECK(RESULT_MEMO_STATS(Hostname).misses == 3 && validations == 5);
+
+    // 8. A working set that fits is never evicted, however many keys fail
+    for (int i = 0; i < 200000; ++i)
+        (void)RESULT_MEMOIZE(Mixed, i % 40, check_even(i % 40));
+    stats = RESULT_MEMO_STATS(Mixed);
+    printf("mixed: hits: %zu, misses: %zu, evictions: %zu\n", stats.hits, stats.misses, stats.evictions);
+    CHECK(stats.misses == 40 && stats.evictions == 0);
+
+    // 9. With a full error slab, failures that keep being looked up outlive one-off ones
+    memset(evaluations, 0, sizeof(evaluations));
+    for (int round = 0; round < 1000; ++round) {
+        for (int hot = 1; hot < 32; hot += 2)
+            (void)RESULT_MEMOIZE(Parity, hot, check_even(hot));
+        int cold = 1025 + 2 * (round % 500);
+        res = RESULT_MEMOIZE(Parity, cold, check_even(cold));
+        CHECK(is_error(res) && unwrap_error(res)->type_code == MATH_ERR_INVALID_OPERATION);
+    }
+    stats = RESULT_MEMO_STATS(Parity);
+    printf("parity: hits: %zu, misses: %zu, evictions: %zu\n", stats.hits, stats.misses, stats.evictions);
+    for (int hot = 1; hot < 32; hot += 2)
+        CHECK(evaluations[hot] == 1);
+    CHECK(stats.misses == 16 + 1000 && stats.evictions > 0);
+
+    // 10. Clearing drops every entry and counter
+    RESULT_MEMO_CLEAR(Parity);
+    stats = RESULT_MEMO_STATS(Parity);
+    CHECK(stats.hits == 0 && stats.misses == 0 && stats.evictions == 0);
+    (void)RESULT_MEMOIZE(Parity, 1, check_even(1));
+    CHECK(evaluations[1] == 2);
+
+    printf("All memoize checks passed\n");
+    return 0;
+}
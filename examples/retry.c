@@ -0,0 +1,149 @@
+#include "../result.h"
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            return 1; \
+        } \
+    } while (0)
+
+#define MS 1000000u
+
+// 1. A virtual clock makes the retry schedule deterministic
+typedef struct {
+    uint64_t now_ns;
+    int      sleeps;
+    uint64_t min_sleep_ns;
+    uint64_t max_sleep_ns;
+} VirtualClock;
+
+uint64_t virtual_now(void *ctx)
+{
+    return ((VirtualClock *)ctx)->now_ns;
+}
+
+void virtual_sleep(void *ctx, uint64_t ns)
+{
+    VirtualClock *clock = ctx;
+
+    clock->now_ns += ns;
+    if (clock->sleeps == 0 || ns < clock->min_sleep_ns)
+        clock->min_sleep_ns = ns;
+    if (ns > clock->max_sleep_ns)
+        clock->max_sleep_ns = ns;
+    clock->sleeps++;
+    printf("  sleep %6.2f ms (t = %6.2f ms)\n", ns / 1e6, clock->now_ns / 1e6);
+}
+
+// 2. Errors are classified in their domain: transient ones are retried
+enum ServiceErrorCode { SERVICE_ERR_BUSY, SERVICE_ERR_BAD_REQUEST };
+DEFINE_ERROR_DOMAIN(SERVICE, 10,
+    ERROR_FLAGS(SERVICE_ERR_BUSY, 503, "Service busy", ERR_FLAG_RETRY_AFTER_HINT),
+    ERROR_FLAGS(SERVICE_ERR_BAD_REQUEST, 400, "Bad request", ERR_FLAG_FATAL)
+);
+
+static int calls;
+
+Result(Int) connect_flaky(int failures)
+{
+    if (calls++ < failures)
+        return Fail(Int, NETWORK_DOMAIN, NET_ERR_CONNECTION_TIMEOUT);
+    return Ok(Int, 42);
+}
+
+Result(Int) open_session(int failures)
+{
+    int fd = TRY(Int, connect_flaky(failures));
+    return Ok(Int, fd);
+}
+
+Result(Int) call_service(int err_code)
+{
+    calls++;
+    return Fail(Int, SERVICE_DOMAIN, err_code);
+}
+
+void reset(VirtualClock *clock)
+{
+    *clock = (VirtualClock){ 0 };
+    calls = 0;
+}
+
+int main()
+{
+    VirtualClock virtual_clock = { 0 };
+    RetryClock clock = { .now_ns = virtual_now, .sleep_ns = virtual_sleep, .ctx = &virtual_clock };
+    RetryPolicy policy = {
+        .max_attempts = 5,
+        .initial_delay_ns = 10 * MS,
+        .max_delay_ns = 100 * MS,
+        .budget_ns = 250 * MS,
+        .seed = 42,
+        .clock = &clock,
+    };
+
+    // 3. Transient failures are retried until success, each delay within its backoff
+    printf("connect, fails 3 times:\n");
+    Result(Int) res = RETRY(Int, policy, connect_flaky(3));
+    CHECK(is_ok(res) && unwrap_ok(res) == 42);
+    CHECK(calls == 4);
+    CHECK(virtual_clock.sleeps == 3);
+    CHECK(virtual_clock.now_ns <= (10 + 20 + 40) * MS);
+
+    // 4. ... or until max_attempts
+    reset(&virtual_clock);
+    printf("connect, always fails:\n");
+    res = RETRY(Int, policy, connect_flaky(100));
+    CHECK(is_error(res) && unwrap_error(res)->type_code == NET_ERR_CONNECTION_TIMEOUT);
+    CHECK(calls == 5);
+    CHECK(virtual_clock.sleeps == 4);
+    CHECK(virtual_clock.now_ns <= (10 + 20 + 40 + 80) * MS);
+
+    // 5. A transient root cause makes the whole chain transient
+    reset(&virtual_clock);
+    printf("session, fails 2 times:\n");
+    res = RETRY(Int, policy, open_session(2));
+    CHECK(is_ok(res));
+    CHECK(calls == 3);
+    CHECK(virtual_clock.sleeps == 2);
+
+    // 6. Throttling errors wait half to all of max_delay, until the budget runs out
+    reset(&virtual_clock);
+    printf("service busy:\n");
+    res = RETRY(Int, policy, call_service(SERVICE_ERR_BUSY));
+    CHECK(is_error(res));
+    CHECK(virtual_clock.sleeps >= 2);
+    CHECK(virtual_clock.min_sleep_ns >= 50 * MS && virtual_clock.max_sleep_ns <= 100 * MS);
+    CHECK(virtual_clock.now_ns <= policy.budget_ns);
+    CHECK(virtual_clock.now_ns + 50 * MS > policy.budget_ns);
+    CHECK(calls == virtual_clock.sleeps + 1 && calls < (int)policy.max_attempts);
+
+    // 7. Fatal errors are never retried
+    reset(&virtual_clock);
+    printf("bad request:\n");
+    res = RETRY(Int, policy, call_service(SERVICE_ERR_BAD_REQUEST));
+    CHECK(is_error(res));
+    CHECK(calls == 1);
+    CHECK(virtual_clock.sleeps == 0 && virtual_clock.now_ns == 0);
+
+    // 8. A zero initial delay still backs off, and a policy without limits is capped
+    reset(&virtual_clock);
+    printf("connect, zero initial delay:\n");
+    RetryPolicy eager = { .max_delay_ns = 100 * MS, .budget_ns = 200 * MS, .seed = 42, .clock = &clock };
+    res = RETRY(Int, eager, connect_flaky(1000));
+    CHECK(is_error(res));
+    CHECK(calls > 1 && calls <= 20);
+    CHECK(virtual_clock.max_sleep_ns > RESULT_RETRY_DEFAULT_INITIAL_DELAY_NS);
+
+    reset(&virtual_clock);
+    printf("connect, no limits:\n");
+    RetryPolicy unlimited = { .seed = 42, .clock = &clock };
+    res = RETRY(Int, unlimited, connect_flaky(1000));
+    CHECK(is_error(res));
+    CHECK(calls == RESULT_RETRY_DEFAULT_MAX_ATTEMPTS);
+    CHECK(virtual_clock.sleeps == RESULT_RETRY_DEFAULT_MAX_ATTEMPTS - 1);
+
+    printf("All retry checks passed\n");
+    return 0;
+}
@@ -0,0 +1,29 @@
+// Exactly one translation unit defines RESULT_IMPLEMENTATION
+#define RESULT_IMPLEMENTATION
+#include "../result.h"
+
+Result(Int) parse_port(const char *value);
+
+Result(Int) load_port(const char *value)
+{
+    int port = TRY(Int, parse_port(value));
+
+    return Ok(Int, port);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <port>\n", argv[0]);
+        return 1;
+    }
+
+    Result(Int) port_res = load_port(argv[1]);
+    if (is_error(port_res)) {
+        print_error_chain(stderr, unwrap_error(port_res));
+        return 1;
+    }
+
+    printf("Port: %d\n", unwrap_ok(port_res));
+    return 0;
+}
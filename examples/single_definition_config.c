@@ -0,0 +1,16 @@
+#include "../result.h"
+
+// Built with -DRESULT_SINGLE_DEFINITION: this file only references the pools
+// defined in single_definition.c
+Result(Int) parse_port(const char *value)
+{
+    char *end;
+    long port = strtol(value, &end, 10);
+
+    if (*end != '\0')
+        return Fail_fmt(Int, PARSE_DOMAIN, PARSE_ERR_UNEXPECTED_CHARACTER, "Unexpected '%c' in port \"%s\"", *end, value);
+    if (port > 65535)
+        return Fail(Int, PARSE_DOMAIN, PARSE_ERR_NUMBER_TOO_LARGE);
+
+    return Ok(Int, (int)port);
+}
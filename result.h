@@ -9,6 +9,15 @@
 #include <stdatomic.h>
 #include <stdarg.h>
 #include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#if !defined(CLOCK_MONOTONIC) && defined(__has_include)
+    #if !defined(__STDC_NO_THREADS__) && __has_include(<threads.h>)
+        #include <threads.h>
+        #define _RESULT_HAVE_THRD_SLEEP
+    #endif
+#endif
 
 // ============= Configuration =============
 
@@ -28,6 +37,38 @@
 #define TRUNC_INDICATOR "..."
 #endif
 
+#ifndef RESULT_DETACHED_CHAIN_DEPTH
+#define RESULT_DETACHED_CHAIN_DEPTH 8
+#endif
+
+#ifndef RESULT_MEMO_PROBE_WINDOW
+#define RESULT_MEMO_PROBE_WINDOW 8
+#endif
+
+#ifndef RESULT_RETRY_DEFAULT_INITIAL_DELAY_NS
+#define RESULT_RETRY_DEFAULT_INITIAL_DELAY_NS 1000000 // 1 ms
+#endif
+
+#ifndef RESULT_RETRY_DEFAULT_MAX_ATTEMPTS
+#define RESULT_RETRY_DEFAULT_MAX_ATTEMPTS 10
+#endif
+
+#ifndef RESULT_BACKTRACE_DEPTH
+#define RESULT_BACKTRACE_DEPTH 4
+#endif
+
+#ifndef RESULT_SYMBOL_CACHE_SIZE
+#define RESULT_SYMBOL_CACHE_SIZE 64
+#endif
+
+#ifndef RESULT_CRASH_DUMP_COUNT
+#define RESULT_CRASH_DUMP_COUNT 16
+#endif
+
+#ifndef RESULT_CRASH_ALTSTACK_SIZE
+#define RESULT_CRASH_ALTSTACK_SIZE 65536
+#endif
+
 // Uncomment the following line to globally enable color in `print_error_chain`
 // #define RESULT_FEATURE_COLOR
 
@@ -51,13 +92,194 @@
     #define _RESULT_COLOR_RESET   ""
 #endif
 
+// ============= Linkage =============
+
+// By default every translation unit gets its own static copy of the error pools
+// and of the helper functions. Define RESULT_SINGLE_DEFINITION in every
+// translation unit of a program (e.g. `-DRESULT_SINGLE_DEFINITION`) and
+// RESULT_IMPLEMENTATION in exactly one of them, before including this header,
+// to share a single set of pools and out-of-line helpers across the program.
+
+#if defined(RESULT_IMPLEMENTATION) && !defined(RESULT_SINGLE_DEFINITION)
+#define RESULT_SINGLE_DEFINITION
+#endif
+
+#ifndef RESULT_SINGLE_DEFINITION
+    #define _RESULT_DEF static inline
+    #define _RESULT_VAR static
+    #define _RESULT_WITH_IMPLEMENTATION
+#elif defined(RESULT_IMPLEMENTATION)
+    #define _RESULT_DEF
+    #define _RESULT_VAR
+    #define _RESULT_WITH_IMPLEMENTATION
+#else
+    #define _RESULT_DEF
+    #define _RESULT_VAR extern
+#endif
+
+// ============= Code Layout =============
+
+// Define RESULT_FEATURE_COLD_PATHS to mark success checks as the expected branch
+// and to keep error construction and `PANIC` out of line, in `cold` functions
+// that the compiler places in `.text.unlikely`, away from the hot code.
+
+#if defined(RESULT_FEATURE_COLD_PATHS) && defined(__GNUC__)
+    #define _RESULT_LIKELY(x)   __builtin_expect(!!(x), 1)
+    #define _RESULT_UNLIKELY(x) __builtin_expect(!!(x), 0)
+    #ifdef RESULT_SINGLE_DEFINITION
+        #define _RESULT_COLD_DEF __attribute__((cold, noinline))
+    #else
+        #define _RESULT_COLD_DEF __attribute__((cold, noinline, unused)) static
+    #endif
+#else
+    #define _RESULT_LIKELY(x)   (x)
+    #define _RESULT_UNLIKELY(x) (x)
+    #define _RESULT_COLD_DEF    _RESULT_DEF
+#endif
+
+// ============= Tracing =============
+
+// Define RESULT_FEATURE_USDT to emit SystemTap-style static probes (provider
+// "result") on error creation and propagation, usable from `perf` or `bpftrace`.
+// A disabled probe is a single `nop`; no library is needed at runtime.
+// Probes and their arguments:
+//   result:error_new  (domain_id, type_code, file, line, cause)
+//   result:from_errno (domain_id, type_code, file, line, errno)
+//   result:propagate  (cause domain_id, cause type_code, file, line, cause)
+
+#ifdef RESULT_FEATURE_USDT
+    #if defined(__has_include)
+        #if __has_include(<sys/sdt.h>)
+            #include <sys/sdt.h>
+            #define _RESULT_HAVE_SYS_SDT
+        #endif
+    #endif
+#endif
+
+#if defined(RESULT_FEATURE_USDT) && defined(_RESULT_HAVE_SYS_SDT)
+    #define _RESULT_PROBE(name, domain_id, type_code, file, line, cause) \
+        STAP_PROBE5(result, name, (long)(domain_id), (long)(type_code), (const char *)(file), (long)(line), (const void *)(cause))
+#elif defined(RESULT_FEATURE_USDT) && defined(__ELF__) && (defined(__x86_64__) || defined(__aarch64__))
+    // Minimal equivalent of <sys/sdt.h> for when the header is not installed
+    #define _RESULT_PROBE(name, domain_id, type_code, file, line, cause) \
+        __asm__ __volatile__ ( \
+            "990: nop\n" \
+            ".pushsection .note.stapsdt,\"?\",\"note\"\n" \
+            ".balign 4\n" \
+            ".4byte 992f-991f, 994f-993f, 3\n" \
+            "991: .asciz \"stapsdt\"\n" \
+            "992: .balign 4\n" \
+            "993: .8byte 990b\n" \
+            ".8byte _.stapsdt.base\n" \
+            ".8byte 0\n" \
+            ".asciz \"result\"\n" \
+            ".asciz \"" #name "\"\n" \
+            ".asciz \"-8@%0 -8@%1 8@%2 -8@%3 8@%4\"\n" \
+            "994: .balign 4\n" \
+            ".popsection\n" \
+            ".ifndef _.stapsdt.base\n" \
+            ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n" \
+            ".weak _.stapsdt.base\n" \
+            ".hidden _.stapsdt.base\n" \
+            "_.stapsdt.base: .space 1\n" \
+            ".size _.stapsdt.base, 1\n" \
+            ".popsection\n" \
+            ".endif\n" \
+            :: "nor"((long)(domain_id)), "nor"((long)(type_code)), "nor"((const char *)(file)), \
+               "nor"((long)(line)), "nor"((const void *)(cause)) \
+        )
+#else
+    #define _RESULT_PROBE(name, domain_id, type_code, file, line, cause) ((void)0)
+#endif
+
+// ============= Timestamps =============
+
+// Define RESULT_FEATURE_TIMESTAMP to stamp every `Error` with a raw cycle
+// counter read (TSC on x86, CNTVCT on AArch64, monotonic clock elsewhere) and
+// show the delay between consecutive frames in `print_error_chain`.
+// The counter is converted to nanoseconds only when a chain is printed, the
+// calibration runs once on first use. This changes the layout of `Error`, so
+// the feature must be enabled for every translation unit of a program.
+
+// Monotonic clock when POSIX or C23 provides one. Strict C11 builds only have
+// the `TIME_UTC` wall clock, which can jump when the system time is changed.
+static inline uint64_t _result_clock_ns(void) {
+    struct timespec ts;
+#if defined(CLOCK_MONOTONIC)
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#elif defined(TIME_MONOTONIC)
+    timespec_get(&ts, TIME_MONOTONIC);
+#else
+    timespec_get(&ts, TIME_UTC);
+#endif
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+#ifdef RESULT_FEATURE_TIMESTAMP
+static inline uint64_t _result_timestamp(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    uint64_t ticks;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return _result_clock_ns();
+#endif
+}
+
+#endif
+
+// ============= Backtraces =============
+
+// Define RESULT_FEATURE_BACKTRACE to record up to RESULT_BACKTRACE_DEPTH return
+// addresses in every `Error`, by walking the frame pointer chain (x86-64 and
+// AArch64, build with `-fno-omit-frame-pointer`). The library's own helpers are
+// never recorded: the first frame is the function that created the error, or
+// its caller when the helpers were inlined into it. Capture does not allocate;
+// addresses are symbolized with `dladdr` only when `print_error_chain` runs,
+// and results are cached per address. Without `dladdr` (e.g. no _GNU_SOURCE
+// on glibc), raw addresses are printed. Link with `-rdynamic` to resolve the
+// symbols of the executable itself. This changes the layout of `Error`, so the
+// feature must be enabled for every translation unit of a program.
+
+#ifdef RESULT_FEATURE_BACKTRACE
+#include <dlfcn.h>
+
+#if defined(__USE_GNU) || defined(__APPLE__) || (defined(_GNU_SOURCE) && !defined(__GLIBC__))
+    #define _RESULT_HAVE_DLADDR
+#endif
+
+__attribute__((always_inline))
+static inline int _result_capture_backtrace(const void **pcs, int max_depth) {
+    int depth = 0;
+#if defined(__x86_64__) || defined(__aarch64__)
+    void **frame = __builtin_frame_address(0);
+
+    while (frame != NULL && depth < max_depth) {
+        void **next = frame[0];
+        if (frame[1] == NULL)
+            break;
+        pcs[depth++] = frame[1];
+
+        // The stack grows down: stop on anything that is not a plausible caller frame
+        if (next <= frame || (uintptr_t)next - (uintptr_t)frame > (1u << 20) || ((uintptr_t)next % sizeof(void *)) != 0)
+            break;
+        frame = next;
+    }
+#else
+    (void)pcs;
+    (void)max_depth;
+#endif
+    return depth;
+}
+#endif
+
 // ============= Panic Handling =============
 
 #ifndef PANIC
-_Noreturn static inline void _panic_internal(const char *msg, const char *file, int line) {
-    fprintf(stderr, "PANIC: %s (%s:%d)\n", msg, file, line);
-    abort();
-}
+#define _RESULT_DEFAULT_PANIC
+_Noreturn _RESULT_COLD_DEF void _panic_internal(const char *msg, const char *file, int line);
 #define PANIC(msg) _panic_internal(msg, __FILE__, __LINE__)
 #endif
 
@@ -70,17 +292,33 @@ typedef struct Error {
     int         raw_code;
     int         type_code;
     const char *message;
+    unsigned    flags;
 
     const struct Error *cause;
     const char         *file;
     int                 line;
     const char         *func;
+#ifdef RESULT_FEATURE_TIMESTAMP
+    uint64_t            timestamp;
+#endif
+#ifdef RESULT_FEATURE_BACKTRACE
+    const void         *backtrace[RESULT_BACKTRACE_DEPTH];
+    int                 backtrace_depth;
+#endif
 } Error;
 
+// Classification flags, given as the last argument of ERROR_FLAGS()
+enum ErrorFlags {
+    ERR_FLAG_TRANSIENT        = 1 << 0, // Retrying the operation may succeed
+    ERR_FLAG_FATAL            = 1 << 1, // Never retry, even if a cause is transient
+    ERR_FLAG_RETRY_AFTER_HINT = 1 << 2, // Transient, caller was asked to slow down: back off to the maximum delay
+};
+
 typedef struct {
     int         raw_code;
     int         type_code;
     const char *message;
+    unsigned    flags;
 } ErrorInfo;
 
 typedef struct {
@@ -90,118 +328,83 @@ typedef struct {
     size_t           error_count;
 } ErrorDomain;
 
-static Error result_error_pool[RESULT_ERROR_POOL_SIZE];
-static _Atomic size_t result_error_pool_index = 0;
+_RESULT_VAR Error result_error_pool[RESULT_ERROR_POOL_SIZE];
+_RESULT_VAR _Atomic size_t result_error_pool_index;
 
-static char result_error_message_pool[RESULT_ERROR_MESSAGE_POOL_SIZE];
-static _Atomic size_t result_error_message_pool_index = 0;
+_RESULT_VAR char result_error_message_pool[RESULT_ERROR_MESSAGE_POOL_SIZE];
+_RESULT_VAR _Atomic size_t result_error_message_pool_index;
 
-static inline const Error *_result_error_new(
+_RESULT_COLD_DEF const Error *_result_error_new(
     const Error *cause, const ErrorDomain *domain, int err_code,
     const char *file, int line, const char *func
-) {
-    size_t index = atomic_fetch_add(&result_error_pool_index, 1);
-    Error *new_err = &result_error_pool[index % RESULT_ERROR_POOL_SIZE];
-
-    new_err->domain_id = domain->domain_id;
-    new_err->domain_name = domain->domain_name;
-    new_err->raw_code = domain->errors[err_code].raw_code;
-    new_err->type_code = err_code;
-    new_err->message = domain->errors[err_code].message;
-    new_err->cause = cause;
-    new_err->file = file;
-    new_err->line = line;
-    new_err->func = func;
-
-    return new_err;
-}
+);
 
-static inline const Error *_result_error_new_fmt(
+_RESULT_COLD_DEF const Error *_result_error_new_fmt(
     const Error *cause, const ErrorDomain *domain, int err_code,
     const char *file, int line, const char *func, const char *format, ...
-) {
-    size_t msg_index = atomic_fetch_add(&result_error_message_pool_index, RESULT_MAX_ERROR_MESSAGE_LEN);
-    char *msg_buffer = &result_error_message_pool[msg_index % RESULT_ERROR_MESSAGE_POOL_SIZE];
-
-    va_list args;
-    va_start(args, format);
-    int required_len = vsnprintf(msg_buffer, RESULT_MAX_ERROR_MESSAGE_LEN, format, args);
-    va_end(args);
-
-    if (required_len >= RESULT_MAX_ERROR_MESSAGE_LEN) {
-        const size_t trunc_indicator_len = sizeof(TRUNC_INDICATOR) - 1;
-        size_t start_pos = RESULT_MAX_ERROR_MESSAGE_LEN - trunc_indicator_len - 1;
-        memcpy(msg_buffer + start_pos, TRUNC_INDICATOR, trunc_indicator_len + 1);
-    }
-
-    size_t index = atomic_fetch_add(&result_error_pool_index, 1);
-    Error *new_err = &result_error_pool[index % RESULT_ERROR_POOL_SIZE];
-
-    new_err->domain_id = domain->domain_id;
-    new_err->domain_name = domain->domain_name;
-    new_err->raw_code = domain->errors[err_code].raw_code;
-    new_err->type_code = err_code;
-    new_err->message = msg_buffer;
-    new_err->cause = cause;
-    new_err->file = file;
-    new_err->line = line;
-    new_err->func = func;
-
-    return new_err;
-}
+);
 
-static inline const Error *_result_from_errno(
+_RESULT_COLD_DEF const Error *_result_from_errno(
     int errno_val, const ErrorDomain *domain, int fallback_err_code,
     const char *file, int line, const char *func
-) {
-    for (size_t i = 0; i < domain->error_count; ++i)
-        if (domain->errors[i].raw_code == errno_val)
-            return _result_error_new(NULL, domain, domain->errors[i].type_code, file, line, func);
+);
 
-    return _result_error_new(NULL, domain, fallback_err_code, file, line, func);
-}
+_RESULT_COLD_DEF const Error *_result_error_propagate(
+    const Error *cause, const ErrorDomain *domain, int err_code,
+    const char *file, int line, const char *func
+);
 
-static inline void print_error_chain(FILE *stream, const Error *error)
-{
+_RESULT_COLD_DEF void print_error_chain(FILE *stream, const Error *error);
 
-    fprintf(stream, "Traceback (root cause first):\n");
-    const Error *chain[RESULT_ERROR_POOL_SIZE];
-    int depth = 0;
+// Union of the classification flags of every error in the chain
+_RESULT_DEF unsigned error_chain_flags(const Error *error);
 
-    while (error != NULL && depth < RESULT_ERROR_POOL_SIZE) {
-        chain[depth++] = error;
-        error = error->cause;
-    }
+// True if the chain has a transient error and no fatal one
+_RESULT_DEF bool error_is_transient(const Error *error);
 
-    for (int i = depth - 1; i >= 0; --i)
-    {
-        const Error *current = chain[i];
-        fprintf(stream,
-            "  File \""
-            _RESULT_COLOR_BLUE "%s"
-            _RESULT_COLOR_RESET "\", line "
-            _RESULT_COLOR_YELLOW "%d"
-            _RESULT_COLOR_RESET ", in "
-            _RESULT_COLOR_GREEN "%s"
-            _RESULT_COLOR_RESET "()\n",
-            current->file, current->line, current->func
-        );
-        fprintf(stream,
-            "    ["
-            _RESULT_COLOR_ORANGE "%s"
-            _RESULT_COLOR_RESET "]: "
-            _RESULT_COLOR_RED "%s"
-            _RESULT_COLOR_RESET " ("
-            _RESULT_COLOR_PURPLE "%d"
-            _RESULT_COLOR_RESET ")"
-            _RESULT_COLOR_RESET "\n",
-            current->domain_name, current->message, current->raw_code
-        );
-    }
-}
+// Owned copy of an error chain, independent of the error pools.
+// Chains deeper than RESULT_DETACHED_CHAIN_DEPTH keep their outermost frames
+// and their root cause.
+typedef struct {
+    Error frames[RESULT_DETACHED_CHAIN_DEPTH];
+    char  messages[RESULT_DETACHED_CHAIN_DEPTH][RESULT_MAX_ERROR_MESSAGE_LEN];
+} DetachedError;
+
+_RESULT_DEF const Error *detach_error_chain(DetachedError *dst, const Error *error);
+
+// ============= Crash Dump =============
+
+// Define RESULT_FEATURE_CRASH_DUMP to enable an async-signal-safe dump of the
+// most recent errors of the pool: no stdio, no allocation, only write(2).
+// `result_install_crash_handler` dumps RESULT_CRASH_DUMP_COUNT errors to stderr
+// on SIGSEGV, SIGBUS, SIGFPE, SIGILL and SIGABRT, then restores the handlers
+// that were installed before and re-raises the signal. `PANIC` dumps them too
+// before aborting. Without RESULT_SINGLE_DEFINITION, only the pool of the
+// calling translation unit is seen.
+// Handlers run on the alternate signal stack, so that a stack overflow can
+// still be reported. If the calling thread has none, a static one of
+// RESULT_CRASH_ALTSTACK_SIZE bytes is installed for it; other threads must set
+// up their own with sigaltstack(2). Requires POSIX with the XSI extensions
+// (e.g. -std=gnu11 or _DEFAULT_SOURCE).
+
+#ifdef RESULT_FEATURE_CRASH_DUMP
+#include <signal.h>
+#include <unistd.h>
+
+#ifndef SA_ONSTACK
+#error "RESULT_FEATURE_CRASH_DUMP requires sigaction with SA_ONSTACK, build with -std=gnu11 or define _DEFAULT_SOURCE"
+#endif
+
+_RESULT_DEF void result_dump_recent(int fd, size_t count);
+_RESULT_DEF void result_install_crash_handler(void);
+_RESULT_DEF void _result_crash_dump_once(void);
+#endif
 
 #define ERROR(name, _code, _message) [name] = {.raw_code = _code, .type_code = name, .message = _message}
 
+#define ERROR_FLAGS(name, _code, _message, _flags) \
+    [name] = {.raw_code = _code, .type_code = name, .message = _message, .flags = (_flags)}
+
 #define DEFINE_ERROR_DOMAIN(name, id, ...) \
     static const ErrorInfo name##_ERRORS[] = { __VA_ARGS__ }; \
     static const ErrorDomain name##_DOMAIN = { \
@@ -246,7 +449,7 @@ static inline void print_error_chain(FILE *stream, const Error *error)
 #define Propagate(Typename, ErrStructPtr) \
     ((Typename##Result){ \
         ._is_ok = false, \
-        .error = _result_error_new(ErrStructPtr, &STANDARD_DOMAIN, STD_ERR_PROPAGATED, __FILE__, __LINE__, __func__) \
+        .error = _result_error_propagate(ErrStructPtr, &STANDARD_DOMAIN, STD_ERR_PROPAGATED, __FILE__, __LINE__, __func__) \
     })
 
 #define Result(Typename) Typename##Result
@@ -255,13 +458,13 @@ static inline void print_error_chain(FILE *stream, const Error *error)
 #define is_error(result) (!(result)._is_ok)
 
 #define unwrap_ok(result) \
-    (is_ok(result) ? (result).value : (PANIC("Called unwrap_ok() on an Error value"), (result).value))
+    (_RESULT_LIKELY(is_ok(result)) ? (result).value : (PANIC("Called unwrap_ok() on an Error value"), (result).value))
 
 #define expect_ok(result, message) \
-    (is_ok(result) ? (result).value : (PANIC(message), (result).value))
+    (_RESULT_LIKELY(is_ok(result)) ? (result).value : (PANIC(message), (result).value))
 
 #define unwrap_error(result) \
-    (is_error(result) ? (result).error : (PANIC("Called unwrap_error() on an Ok value"), (result).error))
+    (_RESULT_LIKELY(is_error(result)) ? (result).error : (PANIC("Called unwrap_error() on an Ok value"), (result).error))
 
 #define error_msg(result) (unwrap_error(result)->message)
 #define error_domain(result) (unwrap_error(result)->domain_name)
@@ -278,7 +481,7 @@ static inline void print_error_chain(FILE *stream, const Error *error)
 #define TRY_CAST(EnclosingTypename, ExprTypename, res_expr) \
     ({ \
         Result(ExprTypename) res = (res_expr); \
-        if (is_error(res)) \
+        if (_RESULT_UNLIKELY(is_error(res))) \
             return Propagate(EnclosingTypename, unwrap_error(res)); \
         unwrap_ok(res); \
     })
@@ -289,7 +492,7 @@ static inline void print_error_chain(FILE *stream, const Error *error)
 #define TRY_FAIL_CAST(EnclosingTypename, ExprTypename, res_expr, FailDomain, FailCode) \
     ({ \
         Result(ExprTypename) res = (res_expr); \
-        if (is_error(res)) { \
+        if (_RESULT_UNLIKELY(is_error(res))) { \
             const Error *cause = unwrap_error(res); \
             const Error *new_err = _result_error_new(cause, &(FailDomain), FailCode, __FILE__, __LINE__, __func__); \
             return ((EnclosingTypename##Result){ ._is_ok = false, .error = new_err }); \
@@ -308,6 +511,58 @@ static inline void print_error_chain(FILE *stream, const Error *error)
             : ((OutputResultTypename##Result){ ._is_ok = false, .error = unwrap_error(_res_map_input) }); \
     })
 
+// ============= Retry =============
+
+// RETRY re-evaluates a Result expression while it fails with a transient error
+// chain (see error_is_transient), sleeping between attempts with a jittered
+// exponential backoff: each delay is drawn uniformly in [0, backoff], backoff
+// starts at `initial_delay_ns` and doubles up to `max_delay_ns`. Errors flagged
+// ERR_FLAG_RETRY_AFTER_HINT wait between half and all of `max_delay_ns`.
+// Retrying stops after `max_attempts` attempts, or before a sleep that would end
+// past `budget_ns` after the first attempt. Zero disables a limit, but a policy
+// without either limit stops after RESULT_RETRY_DEFAULT_MAX_ATTEMPTS attempts.
+// A zero `initial_delay_ns` starts the backoff at
+// RESULT_RETRY_DEFAULT_INITIAL_DELAY_NS, so retries never spin without sleeping.
+// The clock can be replaced, e.g. by a virtual clock in tests.
+
+typedef struct {
+    uint64_t (*now_ns)(void *ctx);
+    void     (*sleep_ns)(void *ctx, uint64_t ns);
+    void      *ctx;
+} RetryClock;
+
+typedef struct {
+    unsigned          max_attempts;
+    uint64_t          initial_delay_ns;
+    uint64_t          max_delay_ns;
+    uint64_t          budget_ns;
+    uint64_t          seed;  // Jitter seed, 0 to seed from the clock
+    const RetryClock *clock; // NULL for the monotonic clock
+} RetryPolicy;
+
+typedef struct {
+    RetryPolicy policy;
+    RetryClock  clock;
+    unsigned    attempts;
+    uint64_t    start_ns;
+    uint64_t    backoff_ns;
+    uint64_t    rng;
+} RetryState;
+
+_RESULT_DEF void _result_retry_begin(RetryState *state, RetryPolicy policy);
+_RESULT_DEF bool _result_retry_next(RetryState *state, const Error *error);
+
+#define RETRY(Typename, policy, res_expr) \
+    ({ \
+        RetryState _retry_state; \
+        Result(Typename) _retry_res; \
+        _result_retry_begin(&_retry_state, (policy)); \
+        do \
+            _retry_res = (res_expr); \
+        while (is_error(_retry_res) && _result_retry_next(&_retry_state, unwrap_error(_retry_res))); \
+        _retry_res; \
+    })
+
 // ============= Optional Handling =============
 
 #define OPTIONAL_TYPE(Typename, Type) \
@@ -324,10 +579,10 @@ static inline void print_error_chain(FILE *stream, const Error *error)
 #define is_none(Varname) (!(Varname)._is_some)
 
 #define unwrap_some(Varname) \
-    (is_some(Varname) ? (Varname).value : (PANIC("Called unwrap_some() on a None value"), (Varname).value))
+    (_RESULT_LIKELY(is_some(Varname)) ? (Varname).value : (PANIC("Called unwrap_some() on a None value"), (Varname).value))
 
 #define expect_some(Varname, message) \
-    (is_some(Varname) ? (Varname).value : (PANIC(message), (Varname).value))
+    (_RESULT_LIKELY(is_some(Varname)) ? (Varname).value : (PANIC(message), (Varname).value))
 
 #define or_some(Varname, default_value) \
     (is_some(Varname) ? unwrap_some(Varname) : (default_value))
@@ -354,6 +609,165 @@ static inline void print_error_chain(FILE *stream, const Error *error)
         target_var = unwrap_some(opt); \
     } while(0)
 
+// ============= Memoization =============
+
+// Fixed-capacity cache for pure functions returning a Result, keyed by the raw
+// bytes of a key value (use scalars, arrays or structs without padding). The
+// key must fully determine the result: two calls with equal key bytes share
+// one cache entry.
+// Failures are cached too, as detached copies of their error chain, so they
+// stay valid when the error pools wrap around. Detached chains live in a
+// separate slab of error slots, so entries holding an Ok value only cost their
+// key and Result. The slot count is an optional last argument of
+// DEFINE_RESULT_MEMO and defaults to a quarter of the capacity. A cached result,
+// including its error chain, is valid until its entry is evicted or the cache
+// is cleared.
+// Eviction uses a clock (second chance) policy, within a probe window of
+// RESULT_MEMO_PROBE_WINDOW entries for the entries, and across the whole slab
+// when a new failure needs an error slot: a failure that keeps being looked up
+// survives the sweep. Caches defined with DEFINE_RESULT_MEMO are not
+// thread-safe, use DEFINE_RESULT_MEMO_THREAD_LOCAL for a per-thread cache.
+
+typedef struct {
+    size_t hits;
+    size_t misses;
+    size_t evictions;
+} ResultMemoStats;
+
+static inline size_t _result_memo_hash(const void *key, size_t size) {
+    const unsigned char *bytes = key;
+    unsigned long long hash = 14695981039346656037ULL;
+
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return (size_t)hash;
+}
+
+#define _DEFINE_RESULT_MEMO(Storage, Name, Typename, KeyType, Capacity, ErrorSlots) \
+    _Static_assert((ErrorSlots) > 0 && (ErrorSlots) <= (Capacity) && (ErrorSlots) <= 65535, \
+        "memo error slots must be between 1 and the cache capacity"); \
+    typedef KeyType Name##MemoKey; \
+    typedef Result(Typename) Name##MemoResult; \
+    typedef struct { \
+        bool             occupied; \
+        bool             referenced; \
+        unsigned short   error_slot; /* Index + 1 in the error slab, 0 for none */ \
+        Name##MemoKey    key; \
+        Name##MemoResult result; \
+    } Name##MemoEntry; \
+    typedef struct { \
+        Name##MemoEntry entries[Capacity]; \
+        DetachedError   errors[ErrorSlots]; \
+        size_t          error_owners[ErrorSlots]; /* Entry index + 1, 0 for free */ \
+        size_t          error_count; \
+        size_t          hand; \
+        size_t          error_hand; \
+        ResultMemoStats stats; \
+    } Name##Memo; \
+    static Storage Name##Memo Name##_memo; \
+    static inline Name##MemoResult *Name##_memo_lookup(const Name##MemoKey *key) { \
+        size_t hash = _result_memo_hash(key, sizeof(*key)); \
+        for (size_t i = 0; i < RESULT_MEMO_PROBE_WINDOW && i < (Capacity); ++i) { \
+            Name##MemoEntry *entry = &Name##_memo.entries[(hash + i) % (Capacity)]; \
+            if (entry->occupied && memcmp(&entry->key, key, sizeof(*key)) == 0) { \
+                entry->referenced = true; \
+                Name##_memo.stats.hits++; \
+                return &entry->result; \
+            } \
+        } \
+        Name##_memo.stats.misses++; \
+        return NULL; \
+    } \
+    static inline void Name##_memo_release_error(Name##MemoEntry *entry) { \
+        if (entry->error_slot != 0) { \
+            Name##_memo.error_owners[entry->error_slot - 1] = 0; \
+            Name##_memo.error_count--; \
+            entry->error_slot = 0; \
+        } \
+    } \
+    static inline size_t Name##_memo_error_victim(void) { \
+        for (;;) { \
+            size_t slot = Name##_memo.error_hand++ % (ErrorSlots); \
+            if (Name##_memo.error_owners[slot] == 0) \
+                return slot; \
+            if (Name##_memo.error_count < (ErrorSlots)) \
+                continue; /* Free slots are taken before any failure is evicted */ \
+            Name##MemoEntry *owner = &Name##_memo.entries[Name##_memo.error_owners[slot] - 1]; \
+            if (owner->referenced) \
+                owner->referenced = false; \
+            else { \
+                owner->occupied = false; \
+                Name##_memo_release_error(owner); \
+                Name##_memo.stats.evictions++; \
+                return slot; \
+            } \
+        } \
+    } \
+    static inline const Error *Name##_memo_store_error(Name##MemoEntry *owner, const Error *error) { \
+        size_t slot = Name##_memo_error_victim(); \
+        Name##_memo.error_owners[slot] = (size_t)(owner - Name##_memo.entries) + 1; \
+        Name##_memo.error_count++; \
+        owner->error_slot = (unsigned short)(slot + 1); \
+        return detach_error_chain(&Name##_memo.errors[slot], error); \
+    } \
+    static inline Name##MemoResult Name##_memo_store(const Name##MemoKey *key, Name##MemoResult result) { \
+        size_t hash = _result_memo_hash(key, sizeof(*key)); \
+        size_t window = (Capacity) < RESULT_MEMO_PROBE_WINDOW ? (Capacity) : RESULT_MEMO_PROBE_WINDOW; \
+        Name##MemoEntry *victim = NULL; \
+        for (size_t i = 0; i < window && victim == NULL; ++i) { \
+            Name##MemoEntry *entry = &Name##_memo.entries[(hash + i) % (Capacity)]; \
+            if (!entry->occupied || memcmp(&entry->key, key, sizeof(*key)) == 0) \
+                victim = entry; \
+        } \
+        for (size_t i = Name##_memo.hand++ % window; victim == NULL; i = (i + 1) % window) { \
+            Name##MemoEntry *entry = &Name##_memo.entries[(hash + i) % (Capacity)]; \
+            if (entry->referenced) \
+                entry->referenced = false; \
+            else { \
+                victim = entry; \
+                Name##_memo.stats.evictions++; \
+            } \
+        } \
+        Name##_memo_release_error(victim); \
+        victim->occupied = true; \
+        victim->referenced = false; \
+        memcpy(&victim->key, key, sizeof(*key)); \
+        victim->result = result; \
+        if (is_error(result)) \
+            victim->result.error = Name##_memo_store_error(victim, result.error); \
+        return victim->result; \
+    } \
+    static inline ResultMemoStats Name##_memo_stats(void) { \
+        return Name##_memo.stats; \
+    } \
+    static inline void Name##_memo_clear(void) { \
+        memset(&Name##_memo, 0, sizeof(Name##_memo)); \
+    }
+
+#define _RESULT_MEMO_DEFAULT_ERROR_SLOTS(Capacity) ((Capacity) / 4 > 0 ? (Capacity) / 4 : 1)
+#define _RESULT_MEMO_DEFAULT(Storage, Name, Typename, KeyType, Capacity) \
+    _DEFINE_RESULT_MEMO(Storage, Name, Typename, KeyType, Capacity, _RESULT_MEMO_DEFAULT_ERROR_SLOTS(Capacity))
+#define _RESULT_MEMO_SELECT(_1, _2, _3, _4, _5, _6, macro, ...) macro
+
+// DEFINE_RESULT_MEMO(Name, Typename, KeyType, Capacity[, ErrorSlots])
+#define DEFINE_RESULT_MEMO(...) \
+    _RESULT_MEMO_SELECT(, __VA_ARGS__, _DEFINE_RESULT_MEMO, _RESULT_MEMO_DEFAULT, )(, __VA_ARGS__)
+
+#define DEFINE_RESULT_MEMO_THREAD_LOCAL(...) \
+    _RESULT_MEMO_SELECT(, __VA_ARGS__, _DEFINE_RESULT_MEMO, _RESULT_MEMO_DEFAULT, )(_Thread_local, __VA_ARGS__)
+
+#define RESULT_MEMOIZE(Name, key_expr, expr) \
+    ({ \
+        Name##MemoKey _memo_key = (key_expr); \
+        Name##MemoResult *_memo_hit = Name##_memo_lookup(&_memo_key); \
+        _memo_hit ? *_memo_hit : Name##_memo_store(&_memo_key, (expr)); \
+    })
+
+#define RESULT_MEMO_STATS(Name) Name##_memo_stats()
+#define RESULT_MEMO_CLEAR(Name) Name##_memo_clear()
+
 // ============= Pre-defined Types =============
 
 // Void type for Results that carry no value
@@ -423,14 +837,14 @@ enum StandardErrorCodes {
 };
 DEFINE_ERROR_DOMAIN(STANDARD, 1,
     ERROR(STD_ERR_GENERIC, 0, "Generic error"),
-    ERROR(STD_ERR_OUT_OF_MEMORY, ENOMEM, "Out of memory"),
+    ERROR_FLAGS(STD_ERR_OUT_OF_MEMORY, ENOMEM, "Out of memory", ERR_FLAG_FATAL),
     ERROR(STD_ERR_INVALID_ARGUMENT, EINVAL, "Invalid argument"),
     ERROR(STD_ERR_NULL_POINTER, EFAULT, "Null pointer"),
     ERROR(STD_ERR_BUFFER_OVERFLOW, EOVERFLOW, "Buffer overflow"),
     ERROR(STD_ERR_NOT_FOUND, ENOENT, "Not found"),
     ERROR(STD_ERR_ACCESS_DENIED, EACCES, "Access denied"),
-    ERROR(STD_ERR_TIMEOUT, ETIMEDOUT, "Timeout"),
-    ERROR(STD_ERR_NOT_IMPLEMENTED, ENOSYS, "Not implemented"),
+    ERROR_FLAGS(STD_ERR_TIMEOUT, ETIMEDOUT, "Timeout", ERR_FLAG_TRANSIENT),
+    ERROR_FLAGS(STD_ERR_NOT_IMPLEMENTED, ENOSYS, "Not implemented", ERR_FLAG_FATAL),
     ERROR(STD_ERR_PROPAGATED, -1, "Error propagated")
 );
 
@@ -454,7 +868,7 @@ DEFINE_ERROR_DOMAIN(IO, 2,
     ERROR(IO_ERR_SEEK_FAILED, ESPIPE, "Seek operation failed"),
     ERROR(IO_ERR_DISK_FULL, ENOSPC, "Disk full"),
     ERROR(IO_ERR_INVALID_PATH, ENOTDIR, "Invalid path"),
-    ERROR(IO_ERR_DEVICE_NOT_READY, ENODEV, "Device not ready")
+    ERROR_FLAGS(IO_ERR_DEVICE_NOT_READY, ENODEV, "Device not ready", ERR_FLAG_TRANSIENT)
 );
 
 enum NetworkErrorCodes {
@@ -469,15 +883,15 @@ enum NetworkErrorCodes {
     NET_ERR_AUTHENTICATION_FAILED
 };
 DEFINE_ERROR_DOMAIN(NETWORK, 3,
-    ERROR(NET_ERR_CONNECTION_FAILED, ECONNREFUSED, "Connection failed"),
-    ERROR(NET_ERR_CONNECTION_REFUSED, ECONNREFUSED, "Connection refused"),
-    ERROR(NET_ERR_CONNECTION_TIMEOUT, ETIMEDOUT, "Connection timeout"),
+    ERROR_FLAGS(NET_ERR_CONNECTION_FAILED, ECONNREFUSED, "Connection failed", ERR_FLAG_TRANSIENT),
+    ERROR_FLAGS(NET_ERR_CONNECTION_REFUSED, ECONNREFUSED, "Connection refused", ERR_FLAG_TRANSIENT),
+    ERROR_FLAGS(NET_ERR_CONNECTION_TIMEOUT, ETIMEDOUT, "Connection timeout", ERR_FLAG_TRANSIENT),
     ERROR(NET_ERR_HOST_NOT_FOUND, EHOSTUNREACH, "Host not found"),
-    ERROR(NET_ERR_NETWORK_UNREACHABLE, ENETUNREACH, "Network unreachable"),
+    ERROR_FLAGS(NET_ERR_NETWORK_UNREACHABLE, ENETUNREACH, "Network unreachable", ERR_FLAG_TRANSIENT),
     ERROR(NET_ERR_PROTOCOL_ERROR, EPROTO, "Protocol error"),
     ERROR(NET_ERR_INVALID_URL, EINVAL, "Invalid URL"),
     ERROR(NET_ERR_SSL_ERROR, EPROTO, "SSL/TLS error"),
-    ERROR(NET_ERR_AUTHENTICATION_FAILED, EACCES, "Authentication failed")
+    ERROR_FLAGS(NET_ERR_AUTHENTICATION_FAILED, EACCES, "Authentication failed", ERR_FLAG_FATAL)
 );
 
 enum ParseErrorCodes {
@@ -514,4 +928,551 @@ DEFINE_ERROR_DOMAIN(MATH, 5,
     ERROR(MATH_ERR_INVALID_OPERATION, EINVAL, "Invalid operation")
 );
 
+// ============= Implementation =============
+
+#ifdef _RESULT_WITH_IMPLEMENTATION
+
+#ifdef _RESULT_DEFAULT_PANIC
+_Noreturn _RESULT_COLD_DEF void _panic_internal(const char *msg, const char *file, int line) {
+    fprintf(stderr, "PANIC: %s (%s:%d)\n", msg, file, line);
+#ifdef RESULT_FEATURE_CRASH_DUMP
+    fflush(stderr);
+    _result_crash_dump_once();
+#endif
+    abort();
+}
+#endif
+
+#ifdef RESULT_FEATURE_TIMESTAMP
+_RESULT_VAR _Atomic uint64_t result_timestamp_ticks_per_ms;
+
+_RESULT_DEF uint64_t _result_timestamp_calibrate(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    uint64_t start_ns = _result_clock_ns();
+    uint64_t start_ticks = _result_timestamp();
+    uint64_t elapsed_ns;
+    do {
+        elapsed_ns = _result_clock_ns() - start_ns;
+    } while (elapsed_ns < 2000000);
+    uint64_t elapsed_ticks = _result_timestamp() - start_ticks;
+    return (uint64_t)((double)elapsed_ticks * 1e6 / (double)elapsed_ns);
+#elif defined(__aarch64__)
+    uint64_t freq;
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(freq));
+    return freq / 1000;
+#else
+    return 1000000;
+#endif
+}
+
+_RESULT_DEF double _result_timestamp_delta_ns(uint64_t from, uint64_t to) {
+    uint64_t ticks_per_ms = atomic_load_explicit(&result_timestamp_ticks_per_ms, memory_order_relaxed);
+    if (ticks_per_ms == 0) {
+        ticks_per_ms = _result_timestamp_calibrate();
+        atomic_store_explicit(&result_timestamp_ticks_per_ms, ticks_per_ms, memory_order_relaxed);
+    }
+
+    double delta = (to >= from) ? (double)(to - from) : -(double)(from - to);
+    return delta * 1e6 / (double)ticks_per_ms;
+}
+
+// Whole nanoseconds, or 3 significant digits in larger units: the clock used
+// for calibration may not be more precise than that
+_RESULT_DEF void _result_print_delta(FILE *stream, double delta_ns) {
+    const char *unit = "ns";
+    double value = delta_ns;
+    double magnitude = delta_ns < 0 ? -delta_ns : delta_ns;
+
+    if (magnitude >= 999.5e6) {
+        unit = "s";
+        value = delta_ns / 1e9;
+    } else if (magnitude >= 999.5e3) {
+        unit = "ms";
+        value = delta_ns / 1e6;
+    } else if (magnitude >= 999.5) {
+        unit = "us";
+        value = delta_ns / 1e3;
+    }
+
+    int precision = 0;
+    if (unit[0] != 'n') {
+        double scaled = value < 0 ? -value : value;
+        precision = scaled < 9.995 ? 2 : scaled < 99.95 ? 1 : 0;
+    }
+    fprintf(stream, " " _RESULT_COLOR_GREY "(%+.*f %s)" _RESULT_COLOR_RESET, precision, value, unit);
+}
+#endif
+
+#ifdef RESULT_FEATURE_BACKTRACE
+typedef struct {
+    const void *pc;
+    const char *symbol;
+    uintptr_t   symbol_offset;
+    const char *module;
+    uintptr_t   module_offset;
+} ResultSymbol;
+
+_RESULT_VAR ResultSymbol result_symbol_cache[RESULT_SYMBOL_CACHE_SIZE];
+_RESULT_VAR _Atomic bool result_symbol_cache_lock;
+
+_RESULT_DEF ResultSymbol _result_symbolize(const void *pc) {
+    size_t slot = ((uintptr_t)pc >> 2) % RESULT_SYMBOL_CACHE_SIZE;
+
+    while (atomic_exchange_explicit(&result_symbol_cache_lock, true, memory_order_acquire))
+        ;
+    ResultSymbol symbol = result_symbol_cache[slot];
+    atomic_store_explicit(&result_symbol_cache_lock, false, memory_order_release);
+    if (symbol.pc == pc)
+        return symbol;
+
+    symbol = (ResultSymbol){ .pc = pc };
+#ifdef _RESULT_HAVE_DLADDR
+    Dl_info info;
+    // Look up the call instruction rather than the return address
+    if (dladdr((const char *)pc - 1, &info) != 0) {
+        symbol.module = info.dli_fname;
+        symbol.module_offset = (uintptr_t)pc - (uintptr_t)info.dli_fbase;
+        if (info.dli_sname != NULL) {
+            symbol.symbol = info.dli_sname;
+            symbol.symbol_offset = (uintptr_t)pc - (uintptr_t)info.dli_saddr;
+        }
+    }
+#endif
+
+    while (atomic_exchange_explicit(&result_symbol_cache_lock, true, memory_order_acquire))
+        ;
+    result_symbol_cache[slot] = symbol;
+    atomic_store_explicit(&result_symbol_cache_lock, false, memory_order_release);
+    return symbol;
+}
+
+_RESULT_DEF void _result_print_backtrace(FILE *stream, const Error *error) {
+    for (int i = 0; i < error->backtrace_depth; ++i) {
+        ResultSymbol symbol = _result_symbolize(error->backtrace[i]);
+
+        fprintf(stream, "      " _RESULT_COLOR_GREY "at ");
+        if (symbol.symbol != NULL)
+            fprintf(stream, "%s+0x%zx", symbol.symbol, (size_t)symbol.symbol_offset);
+        else
+            fprintf(stream, "%p", symbol.pc);
+        if (symbol.module != NULL)
+            fprintf(stream, " (%s+0x%zx)", symbol.module, (size_t)symbol.module_offset);
+        fprintf(stream, _RESULT_COLOR_RESET "\n");
+    }
+}
+#endif
+
+// Takes a pool slot and fills everything but the backtrace, which the public
+// helpers capture themselves so that its first frame is their caller
+_RESULT_COLD_DEF Error *_result_error_alloc(
+    const Error *cause, const ErrorDomain *domain, int err_code,
+    const char *file, int line, const char *func
+) {
+    _RESULT_PROBE(error_new, domain->domain_id, err_code, file, line, cause);
+
+    size_t index = atomic_fetch_add(&result_error_pool_index, 1);
+    Error *new_err = &result_error_pool[index % RESULT_ERROR_POOL_SIZE];
+
+    new_err->domain_id = domain->domain_id;
+    new_err->domain_name = domain->domain_name;
+    new_err->raw_code = domain->errors[err_code].raw_code;
+    new_err->type_code = err_code;
+    new_err->message = domain->errors[err_code].message;
+    new_err->flags = domain->errors[err_code].flags;
+    new_err->cause = cause;
+    new_err->file = file;
+    new_err->line = line;
+    new_err->func = func;
+#ifdef RESULT_FEATURE_TIMESTAMP
+    new_err->timestamp = _result_timestamp();
+#endif
+
+    return new_err;
+}
+
+#ifdef RESULT_FEATURE_BACKTRACE
+    #define _RESULT_CAPTURE_BACKTRACE(err) \
+        ((err)->backtrace_depth = _result_capture_backtrace((err)->backtrace, RESULT_BACKTRACE_DEPTH))
+#else
+    #define _RESULT_CAPTURE_BACKTRACE(err) ((void)0)
+#endif
+
+_RESULT_COLD_DEF const Error *_result_error_new(
+    const Error *cause, const ErrorDomain *domain, int err_code,
+    const char *file, int line, const char *func
+) {
+    Error *new_err = _result_error_alloc(cause, domain, err_code, file, line, func);
+
+    _RESULT_CAPTURE_BACKTRACE(new_err);
+    return new_err;
+}
+
+_RESULT_COLD_DEF const Error *_result_error_new_fmt(
+    const Error *cause, const ErrorDomain *domain, int err_code,
+    const char *file, int line, const char *func, const char *format, ...
+) {
+    size_t msg_index = atomic_fetch_add(&result_error_message_pool_index, RESULT_MAX_ERROR_MESSAGE_LEN);
+    char *msg_buffer = &result_error_message_pool[msg_index % RESULT_ERROR_MESSAGE_POOL_SIZE];
+
+    va_list args;
+    va_start(args, format);
+    int required_len = vsnprintf(msg_buffer, RESULT_MAX_ERROR_MESSAGE_LEN, format, args);
+    va_end(args);
+
+    if (required_len >= RESULT_MAX_ERROR_MESSAGE_LEN) {
+        const size_t trunc_indicator_len = sizeof(TRUNC_INDICATOR) - 1;
+        size_t start_pos = RESULT_MAX_ERROR_MESSAGE_LEN - trunc_indicator_len - 1;
+        memcpy(msg_buffer + start_pos, TRUNC_INDICATOR, trunc_indicator_len + 1);
+    }
+
+    Error *new_err = _result_error_alloc(cause, domain, err_code, file, line, func);
+    new_err->message = msg_buffer;
+
+    _RESULT_CAPTURE_BACKTRACE(new_err);
+    return new_err;
+}
+
+_RESULT_COLD_DEF const Error *_result_from_errno(
+    int errno_val, const ErrorDomain *domain, int fallback_err_code,
+    const char *file, int line, const char *func
+) {
+    int err_code = fallback_err_code;
+
+    for (size_t i = 0; i < domain->error_count; ++i) {
+        if (domain->errors[i].raw_code == errno_val) {
+            err_code = domain->errors[i].type_code;
+            break;
+        }
+    }
+
+    _RESULT_PROBE(from_errno, domain->domain_id, err_code, file, line, (long)errno_val);
+    Error *new_err = _result_error_alloc(NULL, domain, err_code, file, line, func);
+
+    _RESULT_CAPTURE_BACKTRACE(new_err);
+    return new_err;
+}
+
+_RESULT_COLD_DEF const Error *_result_error_propagate(
+    const Error *cause, const ErrorDomain *domain, int err_code,
+    const char *file, int line, const char *func
+) {
+    // Probe arguments are evaluated even without a tracer: a NULL cause reports -1
+    _RESULT_PROBE(propagate, cause ? cause->domain_id : -1, cause ? cause->type_code : -1, file, line, cause);
+    Error *new_err = _result_error_alloc(cause, domain, err_code, file, line, func);
+
+    _RESULT_CAPTURE_BACKTRACE(new_err);
+    return new_err;
+}
+
+_RESULT_COLD_DEF void print_error_chain(FILE *stream, const Error *error)
+{
+
+    fprintf(stream, "Traceback (root cause first):\n");
+    const Error *chain[RESULT_ERROR_POOL_SIZE];
+    int depth = 0;
+
+    while (error != NULL && depth < RESULT_ERROR_POOL_SIZE) {
+        chain[depth++] = error;
+        error = error->cause;
+    }
+
+    for (int i = depth - 1; i >= 0; --i)
+    {
+        const Error *current = chain[i];
+        fprintf(stream,
+            "  File \""
+            _RESULT_COLOR_BLUE "%s"
+            _RESULT_COLOR_RESET "\", line "
+            _RESULT_COLOR_YELLOW "%d"
+            _RESULT_COLOR_RESET ", in "
+            _RESULT_COLOR_GREEN "%s"
+            _RESULT_COLOR_RESET "()",
+            current->file, current->line, current->func
+        );
+#ifdef RESULT_FEATURE_TIMESTAMP
+        if (i < depth - 1)
+            _result_print_delta(stream, _result_timestamp_delta_ns(chain[i + 1]->timestamp, current->timestamp));
+#endif
+        fputc('\n', stream);
+        fprintf(stream,
+            "    ["
+            _RESULT_COLOR_ORANGE "%s"
+            _RESULT_COLOR_RESET "]: "
+            _RESULT_COLOR_RED "%s"
+            _RESULT_COLOR_RESET " ("
+            _RESULT_COLOR_PURPLE "%d"
+            _RESULT_COLOR_RESET ")"
+            _RESULT_COLOR_RESET "\n",
+            current->domain_name, current->message, current->raw_code
+        );
+#ifdef RESULT_FEATURE_BACKTRACE
+        _result_print_backtrace(stream, current);
+#endif
+    }
+}
+
+_RESULT_DEF unsigned error_chain_flags(const Error *error)
+{
+    unsigned flags = 0;
+
+    for (size_t depth = 0; error != NULL && depth < RESULT_ERROR_POOL_SIZE; ++depth, error = error->cause)
+        flags |= error->flags;
+    return flags;
+}
+
+_RESULT_DEF bool error_is_transient(const Error *error)
+{
+    unsigned flags = error_chain_flags(error);
+
+    if (flags & ERR_FLAG_FATAL)
+        return false;
+    return (flags & (ERR_FLAG_TRANSIENT | ERR_FLAG_RETRY_AFTER_HINT)) != 0;
+}
+
+_RESULT_DEF uint64_t _result_retry_default_now(void *ctx)
+{
+    (void)ctx;
+    return _result_clock_ns();
+}
+
+_RESULT_DEF void _result_retry_default_sleep(void *ctx, uint64_t ns)
+{
+    (void)ctx;
+    struct timespec ts = { .tv_sec = (time_t)(ns / 1000000000u), .tv_nsec = (long)(ns % 1000000000u) };
+#if defined(CLOCK_MONOTONIC)
+    while (nanosleep(&ts, &ts) == -1 && errno == EINTR)
+        ;
+#elif defined(_RESULT_HAVE_THRD_SLEEP)
+    while (thrd_sleep(&ts, &ts) == -1)
+        ;
+#else
+    #error "RETRY needs nanosleep (POSIX) or thrd_sleep (<threads.h>) to sleep between attempts"
+#endif
+}
+
+_RESULT_DEF void _result_retry_begin(RetryState *state, RetryPolicy policy)
+{
+    if (policy.max_attempts == 0 && policy.budget_ns == 0)
+        policy.max_attempts = RESULT_RETRY_DEFAULT_MAX_ATTEMPTS;
+    if (policy.initial_delay_ns == 0)
+        policy.initial_delay_ns = RESULT_RETRY_DEFAULT_INITIAL_DELAY_NS;
+
+    state->policy = policy;
+    if (policy.clock != NULL)
+        state->clock = *policy.clock;
+    else
+        state->clock = (RetryClock){ .now_ns = _result_retry_default_now, .sleep_ns = _result_retry_default_sleep };
+
+    state->attempts = 0;
+    state->start_ns = state->clock.now_ns(state->clock.ctx);
+    state->backoff_ns = policy.initial_delay_ns;
+    state->rng = policy.seed != 0 ? policy.seed : (state->start_ns ^ 0x9E3779B97F4A7C15ULL);
+    if (state->rng == 0)
+        state->rng = 1;
+}
+
+_RESULT_DEF bool _result_retry_next(RetryState *state, const Error *error)
+{
+    const RetryPolicy *policy = &state->policy;
+
+    state->attempts++;
+    if (!error_is_transient(error))
+        return false;
+    if (policy->max_attempts != 0 && state->attempts >= policy->max_attempts)
+        return false;
+
+    uint64_t backoff = state->backoff_ns;
+    if (policy->max_delay_ns != 0 && backoff > policy->max_delay_ns)
+        backoff = policy->max_delay_ns;
+    state->backoff_ns = (state->backoff_ns > UINT64_MAX / 2) ? UINT64_MAX : state->backoff_ns * 2;
+
+    // xorshift64*
+    state->rng ^= state->rng >> 12;
+    state->rng ^= state->rng << 25;
+    state->rng ^= state->rng >> 27;
+    uint64_t random = state->rng * 0x2545F4914F6CDD1DULL;
+
+    uint64_t delay;
+    if ((error_chain_flags(error) & ERR_FLAG_RETRY_AFTER_HINT) && policy->max_delay_ns != 0)
+        delay = policy->max_delay_ns / 2 + random % (policy->max_delay_ns / 2 + 1);
+    else
+        delay = (backoff == UINT64_MAX) ? random : random % (backoff + 1);
+
+    if (policy->budget_ns != 0) {
+        uint64_t now = state->clock.now_ns(state->clock.ctx);
+        // A wall clock can go backwards: count that as no time elapsed
+        uint64_t elapsed = now > state->start_ns ? now - state->start_ns : 0;
+        if (elapsed >= policy->budget_ns || delay >= policy->budget_ns - elapsed)
+            return false;
+    }
+
+    state->clock.sleep_ns(state->clock.ctx, delay);
+    return true;
+}
+
+_RESULT_DEF const Error *detach_error_chain(DetachedError *dst, const Error *error)
+{
+    size_t length = 0;
+    for (const Error *it = error; it != NULL && length < RESULT_ERROR_POOL_SIZE; it = it->cause)
+        ++length;
+
+    size_t depth = 0;
+    for (size_t i = 0; error != NULL && i < length && depth < RESULT_DETACHED_CHAIN_DEPTH; ++i, error = error->cause) {
+        // Skip the middle of the chain so that the root cause is always kept
+        if (length > RESULT_DETACHED_CHAIN_DEPTH && depth == RESULT_DETACHED_CHAIN_DEPTH - 1 && i < length - 1)
+            continue;
+
+        Error *frame = &dst->frames[depth];
+        char *message = dst->messages[depth];
+        size_t message_len = 0;
+
+        *frame = *error;
+        if (error->message != NULL)
+            while (message_len < RESULT_MAX_ERROR_MESSAGE_LEN - 1 && error->message[message_len] != '\0')
+                ++message_len;
+        if (message_len > 0)
+            memcpy(message, error->message, message_len);
+        message[message_len] = '\0';
+
+        frame->message = message;
+        frame->cause = NULL;
+        if (depth > 0)
+            dst->frames[depth - 1].cause = frame;
+        ++depth;
+    }
+
+    return depth > 0 ? &dst->frames[0] : NULL;
+}
+
+#ifdef RESULT_FEATURE_CRASH_DUMP
+_RESULT_VAR _Atomic bool result_crash_dump_done;
+
+typedef struct {
+    char   data[512];
+    size_t len;
+} _ResultDumpLine;
+
+_RESULT_DEF void _result_dump_str(_ResultDumpLine *line, const char *str, size_t max_len) {
+    if (str == NULL)
+        str = "?";
+    for (size_t i = 0; i < max_len && str[i] != '\0' && line->len < sizeof(line->data); ++i)
+        line->data[line->len++] = str[i];
+}
+
+_RESULT_DEF void _result_dump_int(_ResultDumpLine *line, long long value) {
+    char digits[24];
+    size_t count = 0;
+    unsigned long long magnitude = value < 0 ? 0ULL - (unsigned long long)value : (unsigned long long)value;
+
+    do {
+        digits[count++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0)
+        digits[count++] = '-';
+
+    while (count > 0 && line->len < sizeof(line->data))
+        line->data[line->len++] = digits[--count];
+}
+
+_RESULT_DEF void _result_dump_flush(int fd, _ResultDumpLine *line) {
+    size_t written = 0;
+
+    while (written < line->len) {
+        ssize_t ret = write(fd, line->data + written, line->len - written);
+        if (ret < 0 && errno == EINTR)
+            continue;
+        if (ret <= 0)
+            break;
+        written += (size_t)ret;
+    }
+    line->len = 0;
+}
+
+_RESULT_DEF void result_dump_recent(int fd, size_t count)
+{
+    int saved_errno = errno;
+    size_t index = atomic_load(&result_error_pool_index);
+    _ResultDumpLine line = { .len = 0 };
+
+    if (count > index)
+        count = index;
+    if (count > RESULT_ERROR_POOL_SIZE)
+        count = RESULT_ERROR_POOL_SIZE;
+
+    _result_dump_str(&line, "Recent errors (most recent first):\n", sizeof(line.data));
+    _result_dump_flush(fd, &line);
+
+    for (size_t i = 0; i < count; ++i) {
+        const Error *error = &result_error_pool[(index - 1 - i) % RESULT_ERROR_POOL_SIZE];
+
+        _result_dump_str(&line, "  #", 3);
+        _result_dump_int(&line, (long long)i);
+        _result_dump_str(&line, " [", 2);
+        _result_dump_str(&line, error->domain_name, 64);
+        _result_dump_str(&line, "]: ", 3);
+        _result_dump_str(&line, error->message, RESULT_MAX_ERROR_MESSAGE_LEN);
+        _result_dump_str(&line, " (", 2);
+        _result_dump_int(&line, error->raw_code);
+        _result_dump_str(&line, ") at ", 5);
+        _result_dump_str(&line, error->file, 256);
+        _result_dump_str(&line, ":", 1);
+        _result_dump_int(&line, error->line);
+        _result_dump_str(&line, " in ", 4);
+        _result_dump_str(&line, error->func, 128);
+        _result_dump_str(&line, "()\n", 3);
+        if (line.len == sizeof(line.data))
+            line.data[line.len - 1] = '\n';
+        _result_dump_flush(fd, &line);
+    }
+    errno = saved_errno;
+}
+
+_RESULT_DEF void _result_crash_dump_once(void)
+{
+    if (!atomic_exchange(&result_crash_dump_done, true))
+        result_dump_recent(STDERR_FILENO, RESULT_CRASH_DUMP_COUNT);
+}
+
+static const int _result_crash_signals[] = { SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT };
+#define _RESULT_CRASH_SIGNAL_COUNT (sizeof(_result_crash_signals) / sizeof(_result_crash_signals[0]))
+
+_RESULT_VAR struct sigaction result_crash_previous_actions[_RESULT_CRASH_SIGNAL_COUNT];
+
+_RESULT_DEF void _result_crash_handler(int sig)
+{
+    _result_crash_dump_once();
+
+    // Hand the signal over to whoever handled it before us
+    for (size_t i = 0; i < _RESULT_CRASH_SIGNAL_COUNT; ++i)
+        if (_result_crash_signals[i] == sig)
+            sigaction(sig, &result_crash_previous_actions[i], NULL);
+    raise(sig);
+}
+
+_RESULT_DEF void result_install_crash_handler(void)
+{
+#ifdef SS_DISABLE
+    static char altstack[RESULT_CRASH_ALTSTACK_SIZE];
+    stack_t current;
+
+    if (sigaltstack(NULL, &current) == 0 && (current.ss_flags & SS_DISABLE)) {
+        stack_t stack = { .ss_sp = altstack, .ss_size = sizeof(altstack), .ss_flags = 0 };
+        sigaltstack(&stack, NULL);
+    }
+#endif
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = _result_crash_handler;
+    action.sa_flags = SA_ONSTACK | SA_RESETHAND;
+    sigemptyset(&action.sa_mask);
+
+    for (size_t i = 0; i < _RESULT_CRASH_SIGNAL_COUNT; ++i)
+        sigaction(_result_crash_signals[i], &action, &result_crash_previous_actions[i]);
+}
+#endif
+
+#endif // _RESULT_WITH_IMPLEMENTATION
+
 #endif // RESULT_H
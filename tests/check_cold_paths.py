@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+# Checks that RESULT_FEATURE_COLD_PATHS shrinks the hot functions of the chaining example,
+# both in bytes (nm -S) and in instructions (objdump -d), and that the .text section does
+# not grow. Only code is covered: the out-of-line helpers add relocations, unwind
+# entries and read-only data, so the text segment reported by `size` grows.
+# Usage: check_cold_paths.py <nm> <objdump> <plain binary> <cold paths binary>
+
+import re
+import subprocess
+import sys
+
+HOT_FUNCTIONS = ('load_config', 'start_application')
+INSTRUCTION = re.compile(r'^\s+[0-9a-f]+:\s')
+FUNCTION = re.compile(r'^[0-9a-f]+ <([^>]+)>:$')
+
+
+def run(*args):
+    return subprocess.run(args, check=True, capture_output=True, text=True).stdout
+
+
+def symbol_sizes(nm, binary):
+    sizes = {}
+    for line in run(nm, '-S', binary).splitlines():
+        fields = line.split()
+        if len(fields) == 4 and fields[2] in 'tT':
+            sizes[fields[3]] = int(fields[1], 16)
+    return sizes
+
+
+def instruction_counts(objdump, binary):
+    counts = {}
+    current = None
+    for line in run(objdump, '-d', '--no-show-raw-insn', binary).splitlines():
+        match = FUNCTION.match(line)
+        if match:
+            current = match.group(1)
+            counts[current] = 0
+        elif current is not None and INSTRUCTION.match(line):
+            counts[current] += 1
+    return counts
+
+
+def text_size(objdump, binary):
+    for line in run(objdump, '-h', binary).splitlines():
+        fields = line.split()
+        if len(fields) >= 3 and fields[1] == '.text':
+            return int(fields[2], 16)
+    return None
+
+
+def main():
+    nm, objdump, plain, cold = sys.argv[1:5]
+    metrics = (
+        ('bytes', symbol_sizes(nm, plain), symbol_sizes(nm, cold)),
+        ('instructions', instruction_counts(objdump, plain), instruction_counts(objdump, cold)),
+    )
+
+    failed = False
+    for name in HOT_FUNCTIONS:
+        for unit, before, after in metrics:
+            if name not in before or name not in after:
+                print(f'{name}: symbol not found')
+                failed = True
+                continue
+            status = 'ok' if after[name] < before[name] else 'did not shrink'
+            print(f'{name}: {before[name]} -> {after[name]} {unit} ({status})')
+            failed |= after[name] >= before[name]
+
+    before, after = text_size(objdump, plain), text_size(objdump, cold)
+    status = 'ok' if before is not None and after is not None and after <= before else 'grew'
+    print(f'.text: {before} -> {after} bytes ({status})')
+    failed |= status != 'ok'
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
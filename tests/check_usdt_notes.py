@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+# Checks that a binary built with RESULT_FEATURE_USDT carries the result:* probes.
+# Usage: check_usdt_notes.py <readelf> <binary>
+
+import subprocess
+import sys
+
+EXPECTED_PROBES = ('error_new', 'propagate', 'from_errno')
+SKIP = 77
+
+
+def main():
+    readelf, binary = sys.argv[1], sys.argv[2]
+
+    with open(binary, 'rb') as f:
+        if f.read(4) != b'\x7fELF':
+            print(f'{binary}: not an ELF binary, skipping')
+            return SKIP
+
+    notes = subprocess.run([readelf, '-n', binary], check=True,
+                           capture_output=True, text=True).stdout
+
+    probes = set()
+    provider = None
+    for line in notes.splitlines():
+        line = line.strip()
+        if line.startswith('Provider:'):
+            provider = line.split(':', 1)[1].strip()
+        elif line.startswith('Name:') and provider == 'result':
+            probes.add(line.split(':', 1)[1].strip())
+
+    missing = [name for name in EXPECTED_PROBES if name not in probes]
+    if missing:
+        print(f'{binary}: missing stapsdt probes: ' + ', '.join(f'result:{name}' for name in missing))
+        return 1
+
+    print(f'{binary}: found ' + ', '.join(f'result:{name}' for name in EXPECTED_PROBES))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())